@@ -1 +1,21 @@
 # Placeholder for root ESLib project file.
+#
+# Deferred work (the ESLib core is not part of this tree yet):
+#
+# - Fixed-dimension ES kernels: once the generic sampler/updater exists, add
+#   template specializations for small compile-time dimensions (12-60 params)
+#   using stack arrays and unrolled loops, with no heap allocation.
+# - NUMA placement: pin pool workers to cores, bind worker buffers, shm
+#   segments and the noise-table replica to the local node, prefer same-node
+#   dispatch, and report per-node evaluations/sec in run statistics.
+# - Mixed precision: store perturbations and candidate blocks as float32
+#   (optionally bfloat16), accumulate gradients and distribution updates in
+#   double.
+# - Observation normalization: per-worker Welford mean/variance accumulators,
+#   merged by the driver once per generation (no per-step data over IPC).
+# - Rollout recorder: optional evaluator hook capturing rod poses, cable
+#   tensions and actions for selected rollouts (generation best, samples) in a
+#   delta-encoded, chunk-compressed stream, with a memory-mapped reader here.
+# - Live telemetry: read-only Unix-domain socket on the driver streaming
+#   generation, best/median fitness, evals/sec, worker utilization and queue
+#   depth; publishing must never block the optimization loop.